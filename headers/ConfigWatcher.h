@@ -0,0 +1,54 @@
+#ifndef CONFIGWATCHER_H
+#define CONFIGWATCHER_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+struct s_configChange
+{
+    std::string file;
+    std::string contents;                                  // Raw file contents
+    std::unordered_map<std::string, std::string> values;   // Only the key=value pairs that changed since the last load
+};
+
+// Loads a set of config files on a worker thread, then watches their directory
+// (inotify on Linux) and reparses a file whenever it is written or replaced.
+// The main thread collects the parsed changes with takeChanges() at a frame boundary.
+class ConfigWatcher
+{
+private:
+    std::string m_directory;
+    std::vector<std::string> m_files;
+
+    // Worker thread only
+    std::unordered_map<std::string, std::string> m_lastContents;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_lastValues;
+
+    // Shared with the main thread
+    std::vector<s_configChange> m_pending;
+    std::mutex m_mutex;
+    std::atomic<bool> m_hasPending{false};
+
+    std::thread m_thread;
+    int m_inotifyFd = -1;
+    int m_wakeFds[2] = {-1, -1};
+
+private:
+    void run();
+    void loadFile(const std::string &file);
+    static std::unordered_map<std::string, std::string> parse(const std::string &contents);
+
+public:
+    ConfigWatcher(const std::string &directory, const std::vector<std::string> &files);
+    ~ConfigWatcher();
+    ConfigWatcher(const ConfigWatcher &) = delete;
+    ConfigWatcher &operator=(const ConfigWatcher &) = delete;
+
+    std::vector<s_configChange> takeChanges();
+};
+
+#endif // CONFIGWATCHER_H
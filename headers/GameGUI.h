@@ -7,10 +7,15 @@
 #include <imgui-SFML.h>
 #include <unordered_map>
 #include <set>
+#include <string>
+#include <algorithm>
 #include <vector>
 #include <iostream>
 #include <stdexcept>
 #include "constants.h"
+#include "ConfigWatcher.h"
+#include "JobSystem.h"
+#include "KeyBindingIndex.h"
 
 enum class MenuState
 {
@@ -34,6 +39,16 @@ enum class FrameRateOption
     FPS_CUSTOM
 };
 
+// Deferred option changes, run once per frame by processCommands().
+// Resolution and fullscreen share one window recreate, the window settings follow it
+enum class OptionCommand
+{
+    CMD_RESOLUTION,
+    CMD_FULLSCREEN,
+    CMD_FRAME_RATE,
+    CMD_VSYNC
+};
+
 class GameGUI
 {
 private:
@@ -45,7 +60,7 @@ private:
     bool m_isFullscreen = false;
     sf::Vector2u m_windowedSize = {DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT};
     sf::Vector2u m_fullscreenSize;
-    bool m_fullscreen_toggle_pending = false;
+    bool m_requestedFullscreen = false;
     int m_resolutionIndex = 0;
     int m_framerateIndex = 0;
     bool m_vsync = false;
@@ -53,13 +68,28 @@ private:
     int m_fxVolume = 77;
     int m_mouseSensitivity = 77;
     std::vector<sf::VideoMode> m_resolutions_list;
+    std::string m_pendingResolution;   // Resolution setting received before the display modes were queried
     const std::array<const char*, 8> m_frameRateOptions = {"Uncapped", "30", "60", "90", "120", "144", "240", "Custom"};
+    const std::array<const char*, 4> m_commandNames = {"resolution", "fullscreen", "frame rate cap", "vsync"};
+    std::set<OptionCommand> m_pendingCommands;
     int m_frameRateCap = 60;
     bool m_isFrameRateUncapped = false;
     FrameRateOption m_selectedFrameRateOption = FrameRateOption::FPS_60;
     int m_customFrameRate = 60;
     std::vector<s_keyBinding> m_keyBindings;
     std::string m_keyBindingErrorMessage;
+    int m_listeningBindingIndex = -1;
+
+    char m_keyBindingSearch[64] = "";
+    KeyBindingIndex m_keyBindingIndex;
+
+    // Hot-reload of the config files
+    ConfigWatcher m_configWatcher;
+    std::string m_imguiIniContents;   // Last imgui.ini loaded or saved by us, to recognise our own writes
+
+    // Background jobs, declared last so workers are joined before the state they capture is destroyed
+    sf::Time m_mainThreadJobBudget = sf::microseconds(MAIN_THREAD_JOB_BUDGET_US);
+    JobSystem m_jobSystem;
 
 private:
     void mainMenu();
@@ -68,22 +98,37 @@ private:
     void creditsMenu();
     void quitMenu();
     void keyBindingsMenu();
-    void applyResolution();
+    bool applyWindowMode(bool resolutionChanged);
+    int findResolutionIndex(unsigned int width, unsigned int height) const;
     void applyFrameRateCap();
+    bool isInputReserved(const s_inputBinding &input) const;
+    bool isInputUnbound(const s_inputBinding &input) const;
     bool isInputValid(const s_inputBinding &input);
     std::string getInputName(const s_inputBinding &input);
+    bool parseInputName(const std::string &name, s_inputBinding &input);
+    void applySettingsConfig(const std::unordered_map<std::string, std::string> &values);
+    void applyKeyBindingsConfig(const std::unordered_map<std::string, std::string> &values);
+    void applyImGuiIni(const std::string &contents);
+    void setupImGuiIni();
     void ensureImGuiContext();
 
 public:
     GameGUI(sf::RenderWindow& window);
     void setStyle();
     void handleEvent(sf::Event &event);
-    void update();
-    void render();
+    void update(sf::Time deltaTime);
+    void simulate(float tickSeconds);
+    void render(float alpha);
     void showMenuTitle(const char *title);
-    void requestFullscreenToggle();
-    void processFullscreenToggle();
+    void queueCommand(OptionCommand command);
+    void processCommands();
+    void processConfigChanges();
+    void saveImGuiIni();
+    size_t addKeyBinding(const std::string &action, const std::string &category, const s_inputBinding &input);
+    bool applyKeyBindings(const std::vector<s_keyBindingChange> &changes);
     sf::Vector2u getWindowSize() const { return m_windowSize; }
+    JobSystem &getJobSystem() { return m_jobSystem; }
+    void setMainThreadJobBudget(sf::Time budget) { m_mainThreadJobBudget = budget; }
 };
 
 #endif // GAMEGUI_H
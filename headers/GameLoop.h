@@ -0,0 +1,55 @@
+#ifndef GAMELOOP_H
+#define GAMELOOP_H
+
+#include <SFML/System/Time.hpp>
+#include "constants.h"
+
+// Fixed timestep loop: the simulation always advances by the same tick duration,
+// whatever the render rate. The leftover time is exposed as an interpolation factor
+// so rendering can blend between the previous and current simulation states.
+class GameLoop
+{
+private:
+    sf::Time m_tickDuration;
+    sf::Time m_maxFrameTime;
+    sf::Time m_accumulator = sf::Time::Zero;
+    unsigned long long m_tickCount = 0;
+
+public:
+    GameLoop(sf::Time tickDuration = sf::seconds(1.f / SIMULATION_TICK_RATE), sf::Time maxFrameTime = sf::seconds(MAX_FRAME_TIME));
+
+    // Runs simulate(tickSeconds) once per whole tick elapsed, returns the number of ticks run
+    template <typename Simulate>
+    int advance(sf::Time frameTime, Simulate &&simulate)
+    {
+        // CLAMP long frames (breakpoints, window recreation) so slow ticks cannot snowball
+        if (frameTime > m_maxFrameTime)
+        {
+            frameTime = m_maxFrameTime;
+        }
+        m_accumulator += frameTime;
+
+        int ticks = 0;
+        while (m_accumulator >= m_tickDuration)
+        {
+            simulate(m_tickDuration.asSeconds());
+            m_accumulator -= m_tickDuration;
+            m_tickCount++;
+            ticks++;
+        }
+        return ticks;
+    }
+
+    float getAlpha() const;
+    sf::Time getTickDuration() const { return m_tickDuration; }
+    unsigned long long getTickCount() const { return m_tickCount; }
+};
+
+// Blends the previous and current simulation states, alpha comes from GameLoop::getAlpha()
+template <typename T>
+T interpolate(const T &previous, const T &current, float alpha)
+{
+    return previous + (current - previous) * alpha;
+}
+
+#endif // GAMELOOP_H
@@ -0,0 +1,81 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class JobPriority
+{
+    High,
+    Normal,
+    Low
+};
+
+struct s_jobStats
+{
+    std::vector<size_t> workerQueueDepths;
+    size_t mainThreadQueueDepth;
+    unsigned long long executedJobs;
+    unsigned long long stolenJobs;
+};
+
+// Work-stealing thread pool. Each worker owns one deque per priority: it pops its
+// own jobs from the back and steals from the front of the other workers' deques.
+// Results that must touch the window, ImGui or GameGUI state are posted back with
+// runOnMainThread() and run by drainMainThread() within a per-frame time budget.
+class JobSystem
+{
+private:
+    static constexpr size_t PRIORITY_COUNT = 3;
+
+    struct s_worker
+    {
+        std::mutex mutex;
+        std::array<std::deque<std::function<void()>>, PRIORITY_COUNT> queues;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<s_worker>> m_workers;
+    std::atomic<bool> m_running{true};
+    std::atomic<size_t> m_nextWorker{0};
+    std::atomic<size_t> m_queuedJobs{0};    // Waiting in a deque
+    std::atomic<size_t> m_pendingJobs{0};   // Queued or running
+    std::atomic<unsigned long long> m_executedJobs{0};
+    std::atomic<unsigned long long> m_stolenJobs{0};
+    std::atomic<size_t> m_sleepingWorkers{0};
+    std::atomic<size_t> m_idleWaiters{0};
+    std::mutex m_sleepMutex;            // Sleep/wake path only, never taken per job while workers are busy
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+
+    std::mutex m_mainThreadMutex;
+    std::deque<std::function<void()>> m_mainThreadQueue;
+
+private:
+    void workerLoop(size_t index);
+    bool popJob(size_t index, std::function<void()> &job);
+
+public:
+    explicit JobSystem(size_t workerCount = 0); // 0 = one worker per core, minus the main thread
+    ~JobSystem();
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    void submit(std::function<void()> job, JobPriority priority = JobPriority::Normal);
+    void runOnMainThread(std::function<void()> continuation);
+    size_t drainMainThread(sf::Time budget);
+    void waitIdle(); // Blocks until every submitted job has run, or the pool stops
+
+    s_jobStats getStats();
+    size_t getWorkerCount() const { return m_workers.size(); }
+};
+
+#endif // JOBSYSTEM_H
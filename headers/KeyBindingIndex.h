@@ -0,0 +1,41 @@
+#ifndef KEYBINDINGINDEX_H
+#define KEYBINDINGINDEX_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "constants.h"
+
+// Search index and visible rows of the key bindings menu. The index is built once,
+// then added bindings are inserted in place; the rows are rebuilt lazily when the
+// bindings, the query or a category change, so an unchanged frame costs nothing.
+class KeyBindingIndex
+{
+private:
+    std::vector<s_keyBindingSearchEntry> m_searchIndex;
+    std::vector<std::string> m_categories;
+    std::unordered_map<std::string, size_t> m_categoryIndices;
+    std::vector<std::vector<size_t>> m_bindingsByCategory;
+    std::set<std::string> m_collapsedCategories;
+    std::string m_query;
+    std::vector<s_keyBindingRow> m_rows;
+    bool m_indexDirty = true;
+    bool m_rowsDirty = true;
+
+private:
+    void rebuildIndex(const std::vector<s_keyBinding> &bindings);
+    void addToCategory(const std::string &category, size_t index);
+    static std::vector<std::string> getTokens(const std::string &action);
+    void rebuildRows(size_t bindingCount);
+
+public:
+    void addBinding(const std::vector<s_keyBinding> &bindings, size_t index);
+    void setQuery(const std::string &query);
+    bool isCollapsed(int categoryIndex) const;
+    void toggleCategory(int categoryIndex);
+    const std::string &getCategory(int categoryIndex) const { return m_categories[categoryIndex]; }
+    const std::vector<s_keyBindingRow> &getRows(const std::vector<s_keyBinding> &bindings);
+};
+
+#endif // KEYBINDINGINDEX_H
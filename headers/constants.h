@@ -2,6 +2,7 @@
 #define CONSTANTS_H
 
 #include <unordered_map>
+#include <string>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 
@@ -13,6 +14,18 @@ constexpr float BUTTON_WIDTH = 200.0f;
 constexpr float BUTTON_HEIGHT = 50.0f;
 constexpr float ITEM_SPACING = 20.0f;
 constexpr float WINDOW_PADDING = 20.0f;
+constexpr float KEY_BINDING_LABEL_WIDTH = 200.0f;
+constexpr float KEY_BINDING_BUTTON_WIDTH = 150.0f;
+
+constexpr float SIMULATION_TICK_RATE = 60.0f;   // Simulation ticks per second, independent of the frame rate cap
+constexpr float MAX_FRAME_TIME = 0.25f;         // Longest frame (seconds) the simulation catches up on
+
+constexpr int   MAIN_THREAD_JOB_BUDGET_US = 2000;  // Time per frame spent running job continuations on the main thread
+
+constexpr const char *CONFIG_DIRECTORY = ".";
+constexpr const char *SETTINGS_FILE = "settings.cfg";
+constexpr const char *KEY_BINDINGS_FILE = "keybindings.cfg";
+constexpr const char *IMGUI_INI_FILE = "imgui.ini";
 
 const std::unordered_map<int, std::string> KEY_NAMES_MAP = {
     {sf::Keyboard::A, "A"}, 
@@ -68,11 +81,32 @@ struct s_inputBinding
     int code;  // This will store either keyboard key code or mouse button code
 };
 
+constexpr s_inputBinding UNBOUND_INPUT = {InputType::Keyboard, sf::Keyboard::Unknown};
+
 struct s_keyBinding
 {
     std::string action;
+    std::string category;
     s_inputBinding input;
     bool isListening;
 };
 
+struct s_keyBindingChange
+{
+    size_t index;  // Index into the key bindings list
+    s_inputBinding input;
+};
+
+struct s_keyBindingSearchEntry
+{
+    std::string token;  // Lowercased action name, starting at a word boundary
+    size_t index;
+};
+
+struct s_keyBindingRow
+{
+    int bindingIndex;  // -1 for a category header row
+    int categoryIndex;
+};
+
 #endif // CONSTANTS_H
\ No newline at end of file
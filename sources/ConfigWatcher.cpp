@@ -0,0 +1,178 @@
+#include "ConfigWatcher.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <set>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#endif
+
+ConfigWatcher::ConfigWatcher(const std::string &directory, const std::vector<std::string> &files) :
+    m_directory(directory),
+    m_files(files)
+{
+#ifdef __linux__
+    // WATCH the directory rather than the files, editors usually replace a file instead of writing it in place
+    m_inotifyFd = inotify_init1(IN_CLOEXEC);
+    if (m_inotifyFd < 0 || inotify_add_watch(m_inotifyFd, m_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+        pipe2(m_wakeFds, O_CLOEXEC) < 0)
+    {
+        std::cerr << "Failed to watch config directory " << m_directory << ", hot-reload disabled" << std::endl;
+        if (m_inotifyFd >= 0)
+        {
+            close(m_inotifyFd);
+            m_inotifyFd = -1;
+        }
+    }
+#endif
+
+    m_thread = std::thread(&ConfigWatcher::run, this);
+}
+
+ConfigWatcher::~ConfigWatcher()
+{
+#ifdef __linux__
+    // WAKE the worker thread so it can exit
+    if (m_wakeFds[1] >= 0)
+    {
+        char wake = 0;
+        (void)write(m_wakeFds[1], &wake, 1);
+    }
+#endif
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+#ifdef __linux__
+    if (m_inotifyFd >= 0) close(m_inotifyFd);
+    if (m_wakeFds[0] >= 0) close(m_wakeFds[0]);
+    if (m_wakeFds[1] >= 0) close(m_wakeFds[1]);
+#endif
+}
+
+std::vector<s_configChange> ConfigWatcher::takeChanges()
+{
+    std::vector<s_configChange> changes;
+    if (!m_hasPending.load(std::memory_order_acquire)) return changes; // NOTHING changed, skip the lock
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    changes.swap(m_pending);
+    m_hasPending.store(false, std::memory_order_release);
+    return changes;
+}
+
+void ConfigWatcher::run()
+{
+    // INITIAL load
+    for (const auto &file : m_files)
+    {
+        loadFile(file);
+    }
+
+#ifdef __linux__
+    if (m_inotifyFd < 0) return;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true)
+    {
+        pollfd fds[2] = {{m_inotifyFd, POLLIN, 0}, {m_wakeFds[0], POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            std::cerr << "Config watcher stopped polling" << std::endl;
+            return;
+        }
+        if (fds[1].revents != 0) return; // SHUTDOWN requested
+
+        ssize_t length = read(m_inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) continue;
+
+        // COLLECT the watched files touched by this batch of events, each one is reloaded once
+        std::set<std::string> changedFiles;
+        for (char *ptr = buffer; ptr < buffer + length;)
+        {
+            const inotify_event *event = reinterpret_cast<const inotify_event *>(ptr);
+            if (event->len > 0 && std::find(m_files.begin(), m_files.end(), event->name) != m_files.end())
+            {
+                changedFiles.insert(event->name);
+            }
+            ptr += sizeof(inotify_event) + event->len;
+        }
+
+        for (const auto &file : changedFiles)
+        {
+            loadFile(file);
+        }
+    }
+#endif
+}
+
+void ConfigWatcher::loadFile(const std::string &file)
+{
+    std::ifstream stream(m_directory + "/" + file);
+    if (!stream.is_open()) return; // MISSING files keep the current values
+
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    std::string contents = buffer.str();
+
+    // SKIP writes that did not change anything (e.g. ImGui saving its own imgui.ini)
+    auto lastContents = m_lastContents.find(file);
+    if (lastContents != m_lastContents.end() && lastContents->second == contents) return;
+
+    // DIFF against the previous load, only changed keys are forwarded
+    s_configChange change;
+    change.file = file;
+    std::unordered_map<std::string, std::string> values = parse(contents);
+    std::unordered_map<std::string, std::string> &lastValues = m_lastValues[file];
+    for (const auto &entry : values)
+    {
+        auto it = lastValues.find(entry.first);
+        if (it == lastValues.end() || it->second != entry.second)
+        {
+            change.values.insert(entry);
+        }
+    }
+    lastValues = std::move(values);
+    m_lastContents[file] = contents;
+    change.contents = std::move(contents);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.push_back(std::move(change));
+    m_hasPending.store(true, std::memory_order_release);
+}
+
+std::unordered_map<std::string, std::string> ConfigWatcher::parse(const std::string &contents)
+{
+    std::unordered_map<std::string, std::string> values;
+    std::istringstream stream(contents);
+    std::string line;
+
+    auto trim = [](const std::string &str)
+    {
+        size_t first = str.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return std::string();
+        size_t last = str.find_last_not_of(" \t\r");
+        return str.substr(first, last - first + 1);
+    };
+
+    while (std::getline(stream, line))
+    {
+        line = trim(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';' || line[0] == '[') continue;
+
+        size_t separator = line.find('=');
+        if (separator == std::string::npos) continue;
+
+        values[trim(line.substr(0, separator))] = trim(line.substr(separator + 1));
+    }
+    return values;
+}
@@ -1,53 +1,54 @@
 #include "GameGUI.h"
+#include <map>
+#include <fstream>
 
 GameGUI::GameGUI(sf::RenderWindow& window) : 
     m_window(window),
     m_currentState(MenuState::MENU_MAIN),
-    m_windowSize(window.getSize())
+    m_windowSize(window.getSize()),
+    m_configWatcher(CONFIG_DIRECTORY, {SETTINGS_FILE, KEY_BINDINGS_FILE, IMGUI_INI_FILE})
 {
     setStyle();
+    setupImGuiIni();
 
-    // Retrieve supported resolutions and framerates
-    m_resolutions_list = sf::VideoMode::getFullscreenModes();
+    // Retrieve supported resolutions in the background, the list is handed over on the main thread
+    m_jobSystem.submit([this]()
+    {
+        std::vector<sf::VideoMode> modes = sf::VideoMode::getFullscreenModes();
+        m_jobSystem.runOnMainThread([this, modes = std::move(modes)]()
+        {
+            m_resolutions_list = modes;
+
+            // SELECT the mode the window actually uses, if it is one of them
+            sf::Vector2u windowSize = m_window.getSize();
+            int index = findResolutionIndex(windowSize.x, windowSize.y);
+            if (index >= 0)
+            {
+                m_resolutionIndex = index;
+            }
+
+            if (!m_pendingResolution.empty())
+            {
+                applySettingsConfig({{"resolution", m_pendingResolution}});
+                m_pendingResolution.clear();
+            }
+        });
+    }, JobPriority::High);
 
     // Initialize key bindings
     m_keyBindings = {
-        {"Move Left", {InputType::Keyboard, sf::Keyboard::Q}, false},
-        {"Move Right", {InputType::Keyboard, sf::Keyboard::D}, false},
-        {"Climb Up", {InputType::Keyboard, sf::Keyboard::Z}, false},
-        {"Climb Down", {InputType::Keyboard, sf::Keyboard::S}, false},
-        {"Primary Action", {InputType::Mouse, sf::Mouse::Left}, false},
-        {"Secondary Action", {InputType::Mouse, sf::Mouse::Right}, false},
-        {"Interact", {InputType::Keyboard, sf::Keyboard::E}, false},
-        {"Jump", {InputType::Keyboard, sf::Keyboard::Space}, false},
-        {"Sprint", {InputType::Keyboard, sf::Keyboard::LShift}, false}};
+        {"Move Left", "Movement", {InputType::Keyboard, sf::Keyboard::Q}, false},
+        {"Move Right", "Movement", {InputType::Keyboard, sf::Keyboard::D}, false},
+        {"Climb Up", "Movement", {InputType::Keyboard, sf::Keyboard::Z}, false},
+        {"Climb Down", "Movement", {InputType::Keyboard, sf::Keyboard::S}, false},
+        {"Jump", "Movement", {InputType::Keyboard, sf::Keyboard::Space}, false},
+        {"Sprint", "Movement", {InputType::Keyboard, sf::Keyboard::LShift}, false},
+        {"Primary Action", "Actions", {InputType::Mouse, sf::Mouse::Left}, false},
+        {"Secondary Action", "Actions", {InputType::Mouse, sf::Mouse::Right}, false},
+        {"Interact", "Actions", {InputType::Keyboard, sf::Keyboard::E}, false}};
 }
 
 
-void GameGUI::applyResolution()
-{
-    if (m_resolutionIndex >= 0 && m_resolutionIndex < m_resolutions_list.size())
-    {
-        sf::VideoMode newMode = m_resolutions_list[m_resolutionIndex];
-        if (m_isFullscreen)
-        {
-            m_window.create(newMode, "Game", sf::Style::Fullscreen);
-        }
-        else
-        {
-            m_window.create(newMode, "Game", sf::Style::Default);
-
-            // Center the window on the screen
-            sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode();
-            m_window.setPosition(sf::Vector2i(
-                (desktopMode.width - newMode.width) / 2,
-                (desktopMode.height - newMode.height) / 2));
-        }
-        // Update ImGui SFML
-        ImGui::SFML::SetCurrentWindow(m_window);
-    }
-}
-
 void GameGUI::applyFrameRateCap()
 {
     switch (m_selectedFrameRateOption)
@@ -85,51 +86,61 @@ void GameGUI::handleEvent(sf::Event &event)
         ImGui::SFML::UpdateFontTexture(); // Update ImGui font texture
     }
 
-    for (auto &binding : m_keyBindings)
+    if (m_listeningBindingIndex >= 0) // Only one binding can be listening at a time
     {
-        if (binding.isListening)
+        s_keyBinding &binding = m_keyBindings[m_listeningBindingIndex];
+        if (event.type == sf::Event::KeyPressed)
         {
-            if (event.type == sf::Event::KeyPressed)
+            if (event.key.code == sf::Keyboard::Escape)
             {
-                if (event.key.code == sf::Keyboard::Escape)
-                {
-                    binding.isListening = false;
-                    m_keyBindingErrorMessage.clear();
-                }
-                else if (isInputValid({InputType::Keyboard, event.key.code}))
-                {
-                    binding.input = {InputType::Keyboard, event.key.code};
-                    binding.isListening = false;
-                    m_keyBindingErrorMessage.clear();
-                }
-                else
-                {
-                    m_keyBindingErrorMessage = "Input already assigned or invalid!";
-                }
+                binding.isListening = false;
+                m_listeningBindingIndex = -1;
+                m_keyBindingErrorMessage.clear();
             }
-            else if (event.type == sf::Event::MouseButtonPressed)
+            else if (isInputValid({InputType::Keyboard, event.key.code}))
             {
-                if (isInputValid({InputType::Mouse, event.mouseButton.button}))
-                {
-                    binding.input = {InputType::Mouse, event.mouseButton.button};
-                    binding.isListening = false;
-                    m_keyBindingErrorMessage.clear();
-                }
-                else
-                {
-                    m_keyBindingErrorMessage = "Input already assigned or invalid!";
-                }
+                binding.input = {InputType::Keyboard, event.key.code};
+                binding.isListening = false;
+                m_listeningBindingIndex = -1;
+                m_keyBindingErrorMessage.clear();
+            }
+            else
+            {
+                m_keyBindingErrorMessage = "Input already assigned or invalid!";
+            }
+        }
+        else if (event.type == sf::Event::MouseButtonPressed)
+        {
+            if (isInputValid({InputType::Mouse, event.mouseButton.button}))
+            {
+                binding.input = {InputType::Mouse, event.mouseButton.button};
+                binding.isListening = false;
+                m_listeningBindingIndex = -1;
+                m_keyBindingErrorMessage.clear();
+            }
+            else
+            {
+                m_keyBindingErrorMessage = "Input already assigned or invalid!";
             }
-            break; // Only one binding can be listening at a time
         }
     }
 }
 
-void GameGUI::update()
+void GameGUI::update(sf::Time deltaTime)
 {
     ensureImGuiContext();
+
+    // SAVE imgui.ini ourselves when ImGui asks for it
+    if (ImGui::GetIO().WantSaveIniSettings)
+    {
+        saveImGuiIni();
+    }
+
+    // RUN finished background work, within the frame budget
+    m_jobSystem.drainMainThread(m_mainThreadJobBudget);
+
     m_windowSize = m_window.getSize();
-    ImGui::SFML::Update(m_window, sf::seconds(1.f / 60.f));
+    ImGui::SFML::Update(m_window, deltaTime);
 
     switch (m_currentState)
     {
@@ -154,8 +165,15 @@ void GameGUI::update()
     }
 }
 
-void GameGUI::render()
+void GameGUI::simulate(float tickSeconds)
+{
+    // Solo game simulation step here, called at the fixed tick rate
+}
+
+void GameGUI::render(float alpha)
 {
+    // Solo game drawing here, blending the previous and current states with interpolate(..., alpha)
+
     ensureImGuiContext();
     ImGui::SFML::Render(m_window);
 }
@@ -168,54 +186,293 @@ void GameGUI::showMenuTitle(const char *title)
 }
 
 
-void GameGUI::requestFullscreenToggle()
+void GameGUI::queueCommand(OptionCommand command)
 {
-    m_fullscreen_toggle_pending = true;
+    m_pendingCommands.insert(command); // REPEATED requests collapse into one
 }
 
 
-void GameGUI::processFullscreenToggle()
+void GameGUI::processCommands()
 {
-    if (!m_fullscreen_toggle_pending) return; // NO toggle requested
+    if (m_pendingCommands.empty()) return; // NOTHING requested
+
+    std::set<OptionCommand> commands;
+    commands.swap(m_pendingCommands);
+
+    // RESOLUTION and FULLSCREEN resolve to a single window recreate with the final mode and style
+    bool resolutionChanged = commands.erase(OptionCommand::CMD_RESOLUTION) > 0;
+    bool fullscreenChanged = commands.erase(OptionCommand::CMD_FULLSCREEN) > 0;
+    if (resolutionChanged || fullscreenChanged)
+    {
+        sf::Clock clock;
+        if (applyWindowMode(resolutionChanged))
+        {
+            std::cout << "Applied window mode in " << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+
+            // RECREATING the window resets its frame rate limit and vsync, re-apply them afterwards
+            commands.insert(OptionCommand::CMD_FRAME_RATE);
+            commands.insert(OptionCommand::CMD_VSYNC);
+        }
+    }
+
+    for (OptionCommand command : commands)
+    {
+        sf::Clock clock;
+        switch (command)
+        {
+            case OptionCommand::CMD_FRAME_RATE:
+                applyFrameRateCap();
+                break;
+            case OptionCommand::CMD_VSYNC:
+                m_window.setVerticalSyncEnabled(m_vsync);
+                break;
+            default: // Window commands are handled above
+                break;
+        }
+        std::cout << "Applied " << m_commandNames[static_cast<int>(command)] << " in "
+                  << clock.getElapsedTime().asMicroseconds() << " us" << std::endl;
+    }
+}
+
+
+bool GameGUI::applyWindowMode(bool resolutionChanged)
+{
+    bool styleChanged = m_requestedFullscreen != m_isFullscreen;
+    bool hasResolution = resolutionChanged && m_resolutionIndex >= 0 &&
+                         m_resolutionIndex < static_cast<int>(m_resolutions_list.size());
+    if (!styleChanged && !hasResolution) return false; // REQUESTS cancelled each other out
 
-    m_fullscreen_toggle_pending = false; // RESET the flag
-    m_isFullscreen = !m_isFullscreen; // TOGGLE the fullscreen flag
     sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode(); // GET desktop video mode
 
-    std::cout << "Toggling fullscreen. New state: " << (m_isFullscreen ? "Fullscreen" : "Windowed") << std::endl;
+    // REMEMBER the windowed size before leaving it
+    if (!m_isFullscreen)
+    {
+        m_windowedSize = m_window.getSize();
+    }
+    m_isFullscreen = m_requestedFullscreen;
+
+    // TARGET mode: the selected resolution, otherwise the desktop (fullscreen) or the last windowed size
+    sf::VideoMode mode = hasResolution   ? m_resolutions_list[m_resolutionIndex]
+                         : m_isFullscreen ? desktopMode
+                                          : sf::VideoMode(m_windowedSize.x, m_windowedSize.y);
 
-    // SAVE the current view settings before changing the window
-    sf::View currentView = m_window.getView();
+    std::cout << "Recreating window: " << mode.width << "x" << mode.height << " "
+              << (m_isFullscreen ? "Fullscreen" : "Windowed") << std::endl;
 
     // SHUTDOWN ImGui before recreating the window
-    ImGui::SFML::Shutdown(); 
+    saveImGuiIni();
+    ImGui::SFML::Shutdown();
 
     if (m_isFullscreen)
     {
-        m_windowedSize = m_window.getSize();
-        std::cout << "Stored windowed size: " << m_windowedSize.x << "x" << m_windowedSize.y << std::endl;
-        m_window.create(desktopMode, "Game Title", sf::Style::Fullscreen);
+        m_window.create(mode, "Game", sf::Style::Fullscreen);
     }
     else
     {
-        m_window.create(sf::VideoMode(m_windowedSize.x, m_windowedSize.y), "Game Title", sf::Style::Default);
-        sf::Vector2i windowPosition(
-            (desktopMode.width - m_windowedSize.x) / 2,
-            (desktopMode.height - m_windowedSize.y) / 2);
-        m_window.setPosition(windowPosition);
+        m_window.create(mode, "Game", sf::Style::Default);
+        m_windowedSize = sf::Vector2u(mode.width, mode.height);
+
+        // Center the window on the screen
+        m_window.setPosition(sf::Vector2i(
+            (static_cast<int>(desktopMode.width) - static_cast<int>(mode.width)) / 2,
+            (static_cast<int>(desktopMode.height) - static_cast<int>(mode.height)) / 2));
     }
 
     if (!ImGui::SFML::Init(m_window))
     {
-        std::cerr << "Failed to initialize ImGui-SFML after toggling fullscreen" << std::endl;
+        std::cerr << "Failed to initialize ImGui-SFML after recreating the window" << std::endl;
     }
 
-    // RESTORE the previous view settings
-    m_window.setView(currentView);
-
-    std::cout << "New window size: " << m_window.getSize().x << "x" << m_window.getSize().y << std::endl;
+    // MATCH the view to the new window size
+    m_windowSize = m_window.getSize();
+    m_window.setView(sf::View(sf::FloatRect(0, 0, m_windowSize.x, m_windowSize.y)));
 
     setStyle();
+    setupImGuiIni();
+    return true;
+}
+
+
+void GameGUI::processConfigChanges()
+{
+    // Parsing happens on the watcher thread, this only picks up what changed since the last frame
+    for (const auto &change : m_configWatcher.takeChanges())
+    {
+        std::cout << "Reloading " << change.file << std::endl;
+        if (change.file == SETTINGS_FILE)
+        {
+            applySettingsConfig(change.values);
+        }
+        else if (change.file == KEY_BINDINGS_FILE)
+        {
+            applyKeyBindingsConfig(change.values);
+        }
+        else if (change.file == IMGUI_INI_FILE)
+        {
+            applyImGuiIni(change.contents);
+        }
+    }
+}
+
+void GameGUI::applySettingsConfig(const std::unordered_map<std::string, std::string> &values)
+{
+    auto parseBool = [](const std::string &value) { return value == "1" || value == "true" || value == "on"; };
+
+    for (const auto &[key, value] : values)
+    {
+        try
+        {
+            if (key == "fullscreen")
+            {
+                m_requestedFullscreen = parseBool(value);
+                queueCommand(OptionCommand::CMD_FULLSCREEN);
+            }
+            else if (key == "resolution")
+            {
+                size_t separator = value.find('x');
+                if (separator == std::string::npos)
+                    throw std::invalid_argument(value);
+                unsigned int width = std::stoi(value.substr(0, separator));
+                unsigned int height = std::stoi(value.substr(separator + 1));
+                if (m_resolutions_list.empty())
+                {
+                    m_pendingResolution = value; // APPLIED once the display modes are known
+                    continue;
+                }
+                int index = findResolutionIndex(width, height);
+                if (index < 0)
+                    throw std::invalid_argument(value); // NOT a supported mode
+
+                // COMPARE with the real window size, the selected index may not describe it yet
+                m_resolutionIndex = index;
+                sf::Vector2u windowSize = m_window.getSize();
+                if (windowSize.x != width || windowSize.y != height)
+                {
+                    queueCommand(OptionCommand::CMD_RESOLUTION);
+                }
+            }
+            else if (key == "frame_rate")
+            {
+                // A listed option ("Uncapped", "60", ...) or any other value as a custom cap
+                auto it = std::find_if(m_frameRateOptions.begin(), m_frameRateOptions.end() - 1,
+                                       [&value](const char *option) { return value == option; });
+                FrameRateOption option = static_cast<FrameRateOption>(it - m_frameRateOptions.begin());
+                int customFrameRate = m_customFrameRate;
+                if (option == FrameRateOption::FPS_CUSTOM)
+                {
+                    customFrameRate = std::clamp(std::stoi(value), 30, 400);
+                }
+                if (option != m_selectedFrameRateOption || customFrameRate != m_customFrameRate)
+                {
+                    m_selectedFrameRateOption = option;
+                    m_customFrameRate = customFrameRate;
+                    queueCommand(OptionCommand::CMD_FRAME_RATE);
+                }
+            }
+            else if (key == "vsync")
+            {
+                if (parseBool(value) != m_vsync)
+                {
+                    m_vsync = parseBool(value);
+                    queueCommand(OptionCommand::CMD_VSYNC);
+                }
+            }
+            else if (key == "master_volume")
+            {
+                m_masterVolume = std::clamp(std::stoi(value), 0, 100);
+            }
+            else if (key == "fx_volume")
+            {
+                m_fxVolume = std::clamp(std::stoi(value), 0, 100);
+            }
+            else if (key == "mouse_sensitivity")
+            {
+                m_mouseSensitivity = std::clamp(std::stoi(value), 0, 100);
+            }
+        }
+        catch (const std::exception &)
+        {
+            std::cerr << "Ignoring invalid setting " << key << "=" << value << std::endl;
+        }
+    }
+}
+
+void GameGUI::applyKeyBindingsConfig(const std::unordered_map<std::string, std::string> &values)
+{
+    std::unordered_map<std::string, size_t> actionIndices;
+    for (size_t i = 0; i < m_keyBindings.size(); i++)
+    {
+        actionIndices[m_keyBindings[i].action] = i;
+    }
+
+    // COLLECT every changed binding, then rebind them together
+    std::vector<s_keyBindingChange> changes;
+    for (const auto &[action, inputName] : values)
+    {
+        auto it = actionIndices.find(action);
+        s_inputBinding input;
+        if (it == actionIndices.end() || !parseInputName(inputName, input))
+        {
+            std::cerr << "Ignoring invalid key binding " << action << "=" << inputName << std::endl;
+            continue;
+        }
+        const s_inputBinding &current = m_keyBindings[it->second].input;
+        if (current.type != input.type || current.code != input.code)
+        {
+            changes.push_back({it->second, input});
+        }
+    }
+
+    if (!changes.empty() && !applyKeyBindings(changes))
+    {
+        std::cerr << "Key bindings not reloaded: " << m_keyBindingErrorMessage << std::endl;
+    }
+}
+
+void GameGUI::applyImGuiIni(const std::string &contents)
+{
+    // IGNORE the file we just saved ourselves
+    if (contents == m_imguiIniContents) return;
+
+    m_imguiIniContents = contents;
+    ensureImGuiContext();
+    ImGui::LoadIniSettingsFromMemory(contents.c_str(), contents.size());
+}
+
+void GameGUI::setupImGuiIni()
+{
+    // DISABLE ImGui's own imgui.ini handling: the watcher loads it and saveImGuiIni() writes it,
+    // so the file is read once and our own writes can be told apart from external edits
+    ImGui::GetIO().IniFilename = nullptr;
+    if (!m_imguiIniContents.empty())
+    {
+        ImGui::LoadIniSettingsFromMemory(m_imguiIniContents.c_str(), m_imguiIniContents.size());
+    }
+}
+
+void GameGUI::saveImGuiIni()
+{
+    size_t size = 0;
+    const char *contents = ImGui::SaveIniSettingsToMemory(&size);
+    ImGui::GetIO().WantSaveIniSettings = false; // WE own saving, ImGui waits for us to clear the request
+
+    if (m_imguiIniContents.size() == size && m_imguiIniContents.compare(0, size, contents, size) == 0) return;
+
+    m_imguiIniContents.assign(contents, size);
+    std::ofstream file(std::string(CONFIG_DIRECTORY) + "/" + IMGUI_INI_FILE);
+    file << m_imguiIniContents;
+}
+
+int GameGUI::findResolutionIndex(unsigned int width, unsigned int height) const
+{
+    for (int i = 0; i < static_cast<int>(m_resolutions_list.size()); i++)
+    {
+        if (m_resolutions_list[i].width == width && m_resolutions_list[i].height == height)
+        {
+            return i;
+        }
+    }
+    return -1;
 }
 
 
@@ -301,10 +558,8 @@ void GameGUI::optionsMenu()
     bool currentFullscreen = m_isFullscreen;
     if (ImGui::Checkbox("Fullscreen", &currentFullscreen))
     {
-        if (currentFullscreen != m_isFullscreen)
-        {
-            requestFullscreenToggle();
-        }
+        m_requestedFullscreen = currentFullscreen;
+        queueCommand(OptionCommand::CMD_FULLSCREEN);
     }
  
     // GRAPHICS - RESOLUTION
@@ -322,7 +577,7 @@ void GameGUI::optionsMenu()
     int prevResolutionIndex = m_resolutionIndex;
     if (ImGui::Combo("##resolutions", &m_resolutionIndex, resolutionLabelsCStr.data(), resolutionLabelsCStr.size()))
     {
-        applyResolution();
+        queueCommand(OptionCommand::CMD_RESOLUTION);
     }
 
     // GRAPHICS - FRAMERATE
@@ -331,7 +586,7 @@ void GameGUI::optionsMenu()
     if (ImGui::Combo("Frame Rate", &currentOption, m_frameRateOptions.data(), m_frameRateOptions.size()))
     {
         m_selectedFrameRateOption = static_cast<FrameRateOption>(currentOption);
-        applyFrameRateCap();
+        queueCommand(OptionCommand::CMD_FRAME_RATE);
     }
 
     if (m_selectedFrameRateOption == FrameRateOption::FPS_CUSTOM)
@@ -339,7 +594,7 @@ void GameGUI::optionsMenu()
         ImGui::SliderInt("Custom Frame Rate", &m_customFrameRate, 30, 400);
         if (ImGui::IsItemDeactivatedAfterEdit())
         {
-            applyFrameRateCap();
+            queueCommand(OptionCommand::CMD_FRAME_RATE);
         }
     }
 
@@ -347,7 +602,7 @@ void GameGUI::optionsMenu()
     ImGui::Text("Vertical Sync");
     if (ImGui::Checkbox("##vsync", &m_vsync))
     {
-        m_window.setVerticalSyncEnabled(m_vsync);
+        queueCommand(OptionCommand::CMD_VSYNC);
     }
 
     // AUDIO
@@ -365,6 +620,18 @@ void GameGUI::optionsMenu()
         m_currentState = MenuState::MENU_KEY_BINDINGS;
     }
 
+    // DIAGNOSTICS - background jobs
+    ImGui::Text("Background Jobs");
+    s_jobStats jobStats = m_jobSystem.getStats();
+    std::string workerDepths;
+    for (size_t depth : jobStats.workerQueueDepths)
+    {
+        workerDepths += std::to_string(depth) + " ";
+    }
+    ImGui::Text("Workers: %zu, queued: %s", jobStats.workerQueueDepths.size(), workerDepths.c_str());
+    ImGui::Text("Main thread queued: %zu", jobStats.mainThreadQueueDepth);
+    ImGui::Text("Executed: %llu, stolen: %llu", jobStats.executedJobs, jobStats.stolenJobs);
+
     ImGui::End();
 }
 
@@ -424,32 +691,61 @@ void GameGUI::keyBindingsMenu()
         m_keyBindingErrorMessage.clear();
     }
 
-    for (auto &binding : m_keyBindings)
+    // SEARCH - only rebuild the visible rows when the query changes
+    ImGui::InputText("Search", m_keyBindingSearch, sizeof(m_keyBindingSearch));
+    m_keyBindingIndex.setQuery(m_keyBindingSearch);
+    const std::vector<s_keyBindingRow> &rows = m_keyBindingIndex.getRows(m_keyBindings);
+
+    // LIST - only the rows in view are submitted, keep room for the error message below
+    ImGui::BeginChild("##keyBindingsList", ImVec2(0, -ImGui::GetFrameHeightWithSpacing()));
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rows.size()));
+    while (clipper.Step())
     {
-        ImGui::Text("%s", binding.action.c_str());
-        ImGui::SameLine(200);
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+        {
+            const s_keyBindingRow &entry = rows[row];
+            if (entry.bindingIndex < 0)
+            {
+                bool collapsed = m_keyBindingIndex.isCollapsed(entry.categoryIndex);
+                ImGui::SetNextItemOpen(!collapsed, ImGuiCond_Always);
+                if (ImGui::CollapsingHeader(m_keyBindingIndex.getCategory(entry.categoryIndex).c_str()) == collapsed)
+                {
+                    m_keyBindingIndex.toggleCategory(entry.categoryIndex); // ROWS are rebuilt next frame
+                }
+                continue;
+            }
 
-        std::string buttonLabel = binding.isListening
-                                      ? "Press a key..."
-                                      : getInputName(binding.input);
+            s_keyBinding &binding = m_keyBindings[entry.bindingIndex];
+            ImGui::PushID(entry.bindingIndex);
+            ImGui::Text("%s", binding.action.c_str());
+            ImGui::SameLine(KEY_BINDING_LABEL_WIDTH);
 
-        if (ImGui::Button((buttonLabel + "##" + binding.action).c_str(), ImVec2(150, 0)))
-        {
-            // Reset all bindings to not listening
-            for (auto &bind : m_keyBindings)
+            std::string buttonLabel = binding.isListening
+                                          ? "Press a key..."
+                                          : getInputName(binding.input);
+
+            if (ImGui::Button(buttonLabel.c_str(), ImVec2(KEY_BINDING_BUTTON_WIDTH, 0)))
             {
-                bind.isListening = false;
+                // Reset the previous listening binding
+                if (m_listeningBindingIndex >= 0)
+                {
+                    m_keyBindings[m_listeningBindingIndex].isListening = false;
+                }
+                // Set this binding to listening
+                binding.isListening = true;
+                m_listeningBindingIndex = entry.bindingIndex;
+                m_keyBindingErrorMessage.clear();
             }
-            // Set this binding to listening
-            binding.isListening = true;
-            m_keyBindingErrorMessage.clear();
-        }
 
-        if (ImGui::IsItemHovered())
-        {
-            ImGui::SetTooltip("Click to rebind");
+            if (ImGui::IsItemHovered())
+            {
+                ImGui::SetTooltip("Click to rebind");
+            }
+            ImGui::PopID();
         }
     }
+    ImGui::EndChild();
 
     // Display error message if there is one
     if (!m_keyBindingErrorMessage.empty())
@@ -462,19 +758,23 @@ void GameGUI::keyBindingsMenu()
     ImGui::End();
 }
 
+bool GameGUI::isInputReserved(const s_inputBinding &input) const
+{
+    // Function keys are kept for the game itself
+    return input.type == InputType::Keyboard &&
+           input.code >= sf::Keyboard::F1 && input.code <= sf::Keyboard::F12;
+}
+
+bool GameGUI::isInputUnbound(const s_inputBinding &input) const
+{
+    return input.type == UNBOUND_INPUT.type && input.code == UNBOUND_INPUT.code;
+}
+
 bool GameGUI::isInputValid(const s_inputBinding &input)
 {
-    if (input.type == InputType::Keyboard)
+    if (isInputReserved(input) || isInputUnbound(input))
     {
-        std::vector<int> invalidKeys = {
-            sf::Keyboard::F1, sf::Keyboard::F2, sf::Keyboard::F3,
-            sf::Keyboard::F4, sf::Keyboard::F5, sf::Keyboard::F6, sf::Keyboard::F7,
-            sf::Keyboard::F8, sf::Keyboard::F9, sf::Keyboard::F10, sf::Keyboard::F11,
-            sf::Keyboard::F12};
-        if (std::find(invalidKeys.begin(), invalidKeys.end(), input.code) != invalidKeys.end())
-        {
-            return false;
-        }
+        return false;
     }
 
     // Check for conflicts with existing bindings
@@ -489,8 +789,110 @@ bool GameGUI::isInputValid(const s_inputBinding &input)
     return true;
 }
 
+size_t GameGUI::addKeyBinding(const std::string &action, const std::string &category, const s_inputBinding &input)
+{
+    // KEEP the action but leave it unbound when its input is taken, the player can rebind it
+    s_inputBinding validInput = input;
+    if (!isInputUnbound(input) && !isInputValid(input))
+    {
+        std::cerr << "Input of " << action << " already assigned or invalid, leaving it unbound" << std::endl;
+        validInput = UNBOUND_INPUT;
+    }
+
+    m_keyBindings.push_back({action, category, validInput, false});
+    m_keyBindingIndex.addBinding(m_keyBindings, m_keyBindings.size() - 1);
+    return m_keyBindings.size() - 1;
+}
+
+bool GameGUI::applyKeyBindings(const std::vector<s_keyBindingChange> &changes)
+{
+    // COLLECT the resulting input of every changed binding, the last change of a binding wins
+    std::unordered_map<size_t, s_inputBinding> changedInputs;
+    for (const auto &change : changes)
+    {
+        if (change.index >= m_keyBindings.size())
+        {
+            m_keyBindingErrorMessage = "Invalid key binding index!";
+            return false;
+        }
+        changedInputs[change.index] = change.input;
+    }
+
+    // CHECK the changed bindings against each other
+    std::map<std::pair<int, int>, size_t> usedInputs;
+    for (const auto &[index, input] : changedInputs)
+    {
+        if (isInputUnbound(input))
+            continue;
+        if (isInputReserved(input) || !usedInputs.insert({{static_cast<int>(input.type), input.code}, index}).second)
+        {
+            m_keyBindingErrorMessage = "Input already assigned or invalid for " + m_keyBindings[index].action + "!";
+            return false;
+        }
+    }
+
+    // CHECK them against the untouched bindings, in a single pass
+    for (size_t i = 0; i < m_keyBindings.size(); i++)
+    {
+        const s_inputBinding &input = m_keyBindings[i].input;
+        if (changedInputs.count(i) || isInputUnbound(input))
+            continue;
+        auto it = usedInputs.find({static_cast<int>(input.type), input.code});
+        if (it != usedInputs.end())
+        {
+            m_keyBindingErrorMessage = "Input already assigned to " + m_keyBindings[i].action +
+                                       " for " + m_keyBindings[it->second].action + "!";
+            return false;
+        }
+    }
+
+    // APPLY all changes at once
+    for (const auto &[index, input] : changedInputs)
+    {
+        m_keyBindings[index].input = input;
+    }
+    if (m_listeningBindingIndex >= 0)
+    {
+        m_keyBindings[m_listeningBindingIndex].isListening = false;
+        m_listeningBindingIndex = -1;
+    }
+    m_keyBindingErrorMessage.clear();
+    return true;
+}
+
+bool GameGUI::parseInputName(const std::string &name, s_inputBinding &input)
+{
+    // Reverse of getInputName()
+    if (name == getInputName(UNBOUND_INPUT))
+    {
+        input = UNBOUND_INPUT;
+        return true;
+    }
+    for (const auto &[code, keyName] : KEY_NAMES_MAP)
+    {
+        if (keyName == name)
+        {
+            input = {InputType::Keyboard, code};
+            return true;
+        }
+    }
+    for (int button = 0; button < sf::Mouse::ButtonCount; button++)
+    {
+        if (getInputName({InputType::Mouse, button}) == name)
+        {
+            input = {InputType::Mouse, button};
+            return true;
+        }
+    }
+    return false;
+}
+
 std::string GameGUI::getInputName(const s_inputBinding &input)
 {
+    if (isInputUnbound(input))
+    {
+        return "Unbound";
+    }
     if (input.type == InputType::Keyboard)
     {
         auto it = KEY_NAMES_MAP.find(input.code);
@@ -527,5 +929,6 @@ void GameGUI::ensureImGuiContext()
             // Consider throwing an exception or handling this error appropriately
         }
         setStyle();
+        setupImGuiIni();
     }
 }
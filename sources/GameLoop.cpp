@@ -0,0 +1,12 @@
+#include "GameLoop.h"
+
+GameLoop::GameLoop(sf::Time tickDuration, sf::Time maxFrameTime) :
+    m_tickDuration(tickDuration),
+    m_maxFrameTime(maxFrameTime)
+{
+}
+
+float GameLoop::getAlpha() const
+{
+    return m_accumulator.asSeconds() / m_tickDuration.asSeconds();
+}
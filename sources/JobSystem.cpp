@@ -0,0 +1,196 @@
+#include "JobSystem.h"
+#include <SFML/System/Clock.hpp>
+#include <iostream>
+
+namespace
+{
+    // Pool and index of the worker running on this thread, nullptr elsewhere
+    thread_local const JobSystem *t_owner = nullptr;
+    thread_local size_t t_workerIndex = 0;
+}
+
+JobSystem::JobSystem(size_t workerCount)
+{
+    if (workerCount == 0)
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        m_workers.push_back(std::make_unique<s_worker>());
+    }
+    // START the threads once every deque exists, they steal from each other right away
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        m_workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_running = false;
+    }
+    m_wake.notify_all();
+    m_idle.notify_all();
+
+    for (auto &worker : m_workers)
+    {
+        worker->thread.join();
+    }
+}
+
+void JobSystem::submit(std::function<void()> job, JobPriority priority)
+{
+    // KEEP jobs spawned by a job of this pool on the same worker, spread the others round-robin
+    size_t index = t_owner == this ? t_workerIndex
+                                   : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+
+    // COUNT the job before it becomes visible, so a thief can never take it below zero
+    m_pendingJobs++;
+    m_queuedJobs++;
+    {
+        std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+        m_workers[index]->queues[static_cast<size_t>(priority)].push_back(std::move(job));
+    }
+
+    // WAKE a worker only if one is asleep, busy workers find the job on their own
+    if (m_sleepingWorkers > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wake.notify_one();
+    }
+}
+
+void JobSystem::runOnMainThread(std::function<void()> continuation)
+{
+    std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+    m_mainThreadQueue.push_back(std::move(continuation));
+}
+
+size_t JobSystem::drainMainThread(sf::Time budget)
+{
+    sf::Clock clock;
+    size_t count = 0;
+
+    // RUN continuations until the budget is spent, the rest waits for the next frame
+    while (clock.getElapsedTime() < budget)
+    {
+        std::function<void()> continuation;
+        {
+            std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+            if (m_mainThreadQueue.empty()) break;
+            continuation = std::move(m_mainThreadQueue.front());
+            m_mainThreadQueue.pop_front();
+        }
+        continuation();
+        count++;
+    }
+    return count;
+}
+
+void JobSystem::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_idleWaiters++;
+    m_idle.wait(lock, [this] { return m_pendingJobs == 0 || !m_running; });
+    m_idleWaiters--;
+}
+
+s_jobStats JobSystem::getStats()
+{
+    s_jobStats stats;
+    for (auto &worker : m_workers)
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        size_t depth = 0;
+        for (const auto &queue : worker->queues)
+        {
+            depth += queue.size();
+        }
+        stats.workerQueueDepths.push_back(depth);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+        stats.mainThreadQueueDepth = m_mainThreadQueue.size();
+    }
+    stats.executedJobs = m_executedJobs;
+    stats.stolenJobs = m_stolenJobs;
+    return stats;
+}
+
+void JobSystem::workerLoop(size_t index)
+{
+    t_owner = this;
+    t_workerIndex = index;
+
+    while (m_running)
+    {
+        // SLEEP only when nothing is queued, m_sleepMutex is never taken while there is work
+        if (m_queuedJobs == 0)
+        {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers++;
+            m_wake.wait(lock, [this] { return m_queuedJobs > 0 || !m_running; });
+            m_sleepingWorkers--;
+            continue;
+        }
+
+        std::function<void()> job;
+        if (!popJob(index, job)) continue; // ANOTHER worker got it first
+
+        try
+        {
+            job();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Job failed: " << e.what() << std::endl;
+        }
+        m_executedJobs++;
+        if (--m_pendingJobs == 0 && m_idleWaiters > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_idle.notify_all();
+        }
+    }
+}
+
+bool JobSystem::popJob(size_t index, std::function<void()> &job)
+{
+    // HIGHER priorities first, from the own deque (newest) then stolen from the others (oldest)
+    for (size_t priority = 0; priority < PRIORITY_COUNT; priority++)
+    {
+        {
+            s_worker &own = *m_workers[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            auto &queue = own.queues[priority];
+            if (!queue.empty())
+            {
+                job = std::move(queue.back());
+                queue.pop_back();
+                m_queuedJobs--;
+                return true;
+            }
+        }
+
+        for (size_t offset = 1; offset < m_workers.size(); offset++)
+        {
+            s_worker &victim = *m_workers[(index + offset) % m_workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            auto &queue = victim.queues[priority];
+            if (!queue.empty())
+            {
+                job = std::move(queue.front());
+                queue.pop_front();
+                m_queuedJobs--;
+                m_stolenJobs++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,148 @@
+#include "KeyBindingIndex.h"
+#include <algorithm>
+#include <cctype>
+
+void KeyBindingIndex::setQuery(const std::string &query)
+{
+    if (query == m_query) return;
+
+    m_query = query;
+    m_rowsDirty = true;
+}
+
+bool KeyBindingIndex::isCollapsed(int categoryIndex) const
+{
+    return m_collapsedCategories.count(m_categories[categoryIndex]) > 0;
+}
+
+void KeyBindingIndex::toggleCategory(int categoryIndex)
+{
+    const std::string &category = m_categories[categoryIndex];
+    if (!m_collapsedCategories.erase(category))
+    {
+        m_collapsedCategories.insert(category);
+    }
+    m_rowsDirty = true;
+}
+
+const std::vector<s_keyBindingRow> &KeyBindingIndex::getRows(const std::vector<s_keyBinding> &bindings)
+{
+    if (m_indexDirty)
+    {
+        rebuildIndex(bindings);
+    }
+    if (m_rowsDirty)
+    {
+        rebuildRows(bindings.size());
+    }
+    return m_rows;
+}
+
+void KeyBindingIndex::addBinding(const std::vector<s_keyBinding> &bindings, size_t index)
+{
+    if (m_indexDirty) return; // The pending full build will pick it up
+
+    // INSERT the new tokens in place, the index stays sorted
+    addToCategory(bindings[index].category, index);
+    for (std::string &token : getTokens(bindings[index].action))
+    {
+        auto it = std::lower_bound(m_searchIndex.begin(), m_searchIndex.end(), token,
+                                   [](const s_keyBindingSearchEntry &entry, const std::string &value) { return entry.token < value; });
+        m_searchIndex.insert(it, {std::move(token), index});
+    }
+    m_rowsDirty = true;
+}
+
+void KeyBindingIndex::rebuildIndex(const std::vector<s_keyBinding> &bindings)
+{
+    m_indexDirty = false;
+    m_rowsDirty = true;
+    m_searchIndex.clear();
+    m_categories.clear();
+    m_categoryIndices.clear();
+    m_bindingsByCategory.clear();
+
+    for (size_t i = 0; i < bindings.size(); i++)
+    {
+        addToCategory(bindings[i].category, i);
+        for (std::string &token : getTokens(bindings[i].action))
+        {
+            m_searchIndex.push_back({std::move(token), i});
+        }
+    }
+
+    std::sort(m_searchIndex.begin(), m_searchIndex.end(),
+              [](const s_keyBindingSearchEntry &a, const s_keyBindingSearchEntry &b) { return a.token < b.token; });
+}
+
+void KeyBindingIndex::addToCategory(const std::string &category, size_t index)
+{
+    // GROUP by category, in order of first appearance
+    auto it = m_categoryIndices.find(category);
+    if (it == m_categoryIndices.end())
+    {
+        it = m_categoryIndices.emplace(category, m_categories.size()).first;
+        m_categories.push_back(category);
+        m_bindingsByCategory.emplace_back();
+    }
+    m_bindingsByCategory[it->second].push_back(index);
+}
+
+std::vector<std::string> KeyBindingIndex::getTokens(const std::string &action)
+{
+    // INDEX every word of the action name, so "left" matches "Move Left"
+    std::string name = action;
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    std::vector<std::string> tokens;
+    for (size_t pos = 0; pos < name.size(); pos++)
+    {
+        if (name[pos] != ' ' && (pos == 0 || name[pos - 1] == ' '))
+        {
+            tokens.push_back(name.substr(pos));
+        }
+    }
+    return tokens;
+}
+
+void KeyBindingIndex::rebuildRows(size_t bindingCount)
+{
+    m_rowsDirty = false;
+    m_rows.clear();
+
+    std::string query = m_query;
+    std::transform(query.begin(), query.end(), query.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    // MATCH - every token starting with the query sits in one contiguous range of the sorted index
+    std::vector<bool> matches(bindingCount, query.empty());
+    if (!query.empty())
+    {
+        auto it = std::lower_bound(m_searchIndex.begin(), m_searchIndex.end(), query,
+                                   [](const s_keyBindingSearchEntry &entry, const std::string &value) { return entry.token < value; });
+        for (; it != m_searchIndex.end() && it->token.compare(0, query.size(), query) == 0; ++it)
+        {
+            matches[it->index] = true;
+        }
+    }
+
+    for (size_t category = 0; category < m_categories.size(); category++)
+    {
+        bool headerAdded = false;
+        bool collapsed = m_collapsedCategories.count(m_categories[category]) > 0;
+        for (size_t index : m_bindingsByCategory[category])
+        {
+            if (!matches[index])
+                continue;
+            if (!headerAdded)
+            {
+                m_rows.push_back({-1, static_cast<int>(category)});
+                headerAdded = true;
+            }
+            if (collapsed)
+                break;
+            m_rows.push_back({static_cast<int>(index), static_cast<int>(category)});
+        }
+    }
+}
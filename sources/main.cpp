@@ -3,6 +3,7 @@
 #include <imgui-SFML.h>
 #include <iostream>
 #include "GameGUI.h"
+#include "GameLoop.h"
 
 int main()
 {
@@ -19,10 +20,13 @@ int main()
 
         GameGUI gui(window);
 
+        GameLoop gameLoop;
         sf::Clock deltaClock;
 
         while (window.isOpen())
         {
+            sf::Time frameTime = deltaClock.restart();
+
             sf::Event event;
             while (window.pollEvent(event))
             {
@@ -32,16 +36,24 @@ int main()
                     window.close();
                 }
             }
-            // PROCESS the fullscreen toggle request
-            gui.processFullscreenToggle();
+            // APPLY edited config files, before the option commands they may queue
+            gui.processConfigChanges();
+
+            // PROCESS the option changes queued during the last frame
+            gui.processCommands();
+
+            // SIMULATE in fixed ticks, decoupled from the frame rate cap
+            gameLoop.advance(frameTime, [&gui](float tickSeconds) { gui.simulate(tickSeconds); });
 
+            // GUI stays on the render cadence, the game is drawn between its last two ticks
             window.clear();
-            gui.update();
+            gui.update(frameTime);
 
-            gui.render();
+            gui.render(gameLoop.getAlpha());
             window.display();
         }
 
+        gui.saveImGuiIni();
         ImGui::SFML::Shutdown();
     }
     catch (const std::exception &e)
@@ -0,0 +1,54 @@
+#include <SFML/System/Clock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include "JobSystem.h"
+
+// Scaling across worker counts: uneven CPU-bound jobs, so idle workers have to steal.
+constexpr int JOB_COUNT = 4000;
+
+int main()
+{
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "Cores: " << cores << std::endl;
+
+    float baselineMs = 0.0f;
+    for (size_t workers = 1; workers <= cores; workers *= 2)
+    {
+        JobSystem jobs(workers);
+        std::atomic<double> sink{0.0};
+
+        sf::Clock clock;
+        for (int i = 0; i < JOB_COUNT; i++)
+        {
+            int iterations = 2000 + (i % 16) * 1000;
+            jobs.submit([&sink, iterations]()
+            {
+                double sum = 0.0;
+                for (int k = 0; k < iterations; k++)
+                {
+                    sum += std::sqrt(static_cast<double>(k));
+                }
+                sink = sink + sum;
+            }, static_cast<JobPriority>(i % 3));
+        }
+        jobs.waitIdle();
+        float ms = clock.getElapsedTime().asMicroseconds() / 1000.0f;
+        if (workers == 1)
+        {
+            baselineMs = ms;
+        }
+
+        s_jobStats stats = jobs.getStats();
+        std::cout << workers << " workers: " << ms << " ms, speedup " << baselineMs / ms
+                  << ", executed " << stats.executedJobs << ", stolen " << stats.stolenJobs << std::endl;
+        if (stats.executedJobs != JOB_COUNT)
+        {
+            std::cerr << "Not every job ran" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
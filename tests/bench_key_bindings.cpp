@@ -0,0 +1,100 @@
+#include <SFML/System/Clock.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "KeyBindingIndex.h"
+
+// 10k synthetic bindings (mods and tools registering actions): everything the key
+// bindings menu computes in a frame must stay under the 1 ms budget.
+constexpr int   BINDING_COUNT = 10000;
+constexpr int   CATEGORY_COUNT = 50;
+constexpr float FRAME_BUDGET_MS = 1.0f;
+
+int main()
+{
+    std::vector<s_keyBinding> bindings;
+    for (int i = 0; i < BINDING_COUNT; i++)
+    {
+        bindings.push_back({"Mod Action " + std::to_string(i),
+                            "Mod " + std::to_string(i % CATEGORY_COUNT),
+                            UNBOUND_INPUT, false});
+    }
+    bindings.push_back({"Move Left", "Movement", {InputType::Keyboard, sf::Keyboard::Q}, false});
+
+    KeyBindingIndex index;
+    bool passed = true;
+    auto report = [&passed](const char *name, sf::Time time, bool perFrame)
+    {
+        float ms = time.asMicroseconds() / 1000.0f;
+        bool overBudget = perFrame && ms > FRAME_BUDGET_MS;
+        std::cout << name << ": " << ms << " ms" << (overBudget ? "  OVER BUDGET" : "") << std::endl;
+        passed = passed && !overBudget;
+    };
+
+    // INDEX build, once when the bindings are registered
+    sf::Clock clock;
+    size_t rowCount = index.getRows(bindings).size();
+    report("Initial index build (startup)", clock.getElapsedTime(), false);
+    if (rowCount != bindings.size() + CATEGORY_COUNT + 1)
+    {
+        std::cerr << "Unexpected row count " << rowCount << std::endl;
+        return 1;
+    }
+
+    // STEADY frame, nothing changed
+    clock.restart();
+    index.getRows(bindings);
+    report("Unchanged frame", clock.getElapsedTime(), true);
+
+    // TYPING a query, one keystroke per frame
+    std::string query;
+    sf::Time slowestKeystroke;
+    for (char c : std::string("action 12"))
+    {
+        query += c;
+        clock.restart();
+        index.setQuery(query);
+        index.getRows(bindings);
+        slowestKeystroke = std::max(slowestKeystroke, clock.getElapsedTime());
+    }
+    report("Slowest keystroke", slowestKeystroke, true);
+
+    // SEARCH matches any word of the action name
+    index.setQuery("LEFT");
+    const std::vector<s_keyBindingRow> &rows = index.getRows(bindings);
+    if (rows.size() != 2 || bindings[rows[1].bindingIndex].action != "Move Left")
+    {
+        std::cerr << "Search for \"LEFT\" did not find Move Left" << std::endl;
+        return 1;
+    }
+
+    // COLLAPSING a category
+    index.setQuery("");
+    index.getRows(bindings);
+    clock.restart();
+    index.toggleCategory(0);
+    rowCount = index.getRows(bindings).size();
+    report("Category toggle", clock.getElapsedTime(), true);
+    if (rowCount != bindings.size() + CATEGORY_COUNT + 1 - BINDING_COUNT / CATEGORY_COUNT)
+    {
+        std::cerr << "Collapsed category still shows its bindings" << std::endl;
+        return 1;
+    }
+
+    // ADDING one binding to the 10k index, e.g. a mod registering an action while the menu is open
+    bindings.push_back({"Late Action Zeta", "Late Mod", UNBOUND_INPUT, false});
+    clock.restart();
+    index.addBinding(bindings, bindings.size() - 1);
+    size_t rowsAfterAdd = index.getRows(bindings).size();
+    report("Add one binding", clock.getElapsedTime(), true);
+    index.setQuery("zeta");
+    const std::vector<s_keyBindingRow> &addedRows = index.getRows(bindings);
+    if (rowsAfterAdd != rowCount + 2 || addedRows.size() != 2 ||
+        addedRows[1].bindingIndex != static_cast<int>(bindings.size() - 1))
+    {
+        std::cerr << "Added binding not indexed" << std::endl;
+        return 1;
+    }
+
+    return passed ? 0 : 1;
+}
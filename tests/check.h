@@ -0,0 +1,26 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <iostream>
+
+// Minimal assertion helpers shared by the headless tests
+
+inline int g_checkFailures = 0;
+
+inline void check(bool condition, const char *message)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << message << std::endl;
+        g_checkFailures++;
+    }
+}
+
+// Prints the summary line of a test executable and returns its exit code
+inline int reportChecks(const char *suite)
+{
+    std::cout << suite << ": " << (g_checkFailures == 0 ? "all tests passed" : "tests failed") << std::endl;
+    return g_checkFailures == 0 ? 0 : 1;
+}
+
+#endif // CHECK_H
@@ -0,0 +1,63 @@
+#include <vector>
+#include "GameLoop.h"
+#include "check.h"
+
+// The simulation must not depend on the render rate: stepping the same body at 30 fps,
+// 144 fps and uncapped (short, irregular frames) has to give identical states tick for tick.
+
+struct s_body
+{
+    float position = 0.0f;
+    float velocity = 0.0f;
+};
+
+constexpr unsigned long long TICK_COUNT = 600;
+
+s_body simulate(const std::vector<sf::Time> &frameTimes)
+{
+    GameLoop loop;
+    s_body current;
+    size_t frame = 0;
+
+    while (loop.getTickCount() < TICK_COUNT)
+    {
+        loop.advance(frameTimes[frame++ % frameTimes.size()], [&](float tickSeconds)
+        {
+            if (loop.getTickCount() >= TICK_COUNT) return;
+            current.velocity += 9.81f * tickSeconds;
+            current.position += current.velocity * tickSeconds;
+        });
+    }
+    return current;
+}
+
+int main()
+{
+    // FRAME RATES - uncapped frames vary between 0.3 and 2.9 ms
+    std::vector<sf::Time> uncapped;
+    for (int i = 0; i < 97; i++)
+    {
+        uncapped.push_back(sf::microseconds(300 + (i * 7919) % 2600));
+    }
+    s_body at30 = simulate({sf::microseconds(1000000 / 30)});
+    s_body at144 = simulate({sf::microseconds(1000000 / 144)});
+    s_body atUncapped = simulate(uncapped);
+    check(at30.position == at144.position && at30.velocity == at144.velocity, "30 fps and 144 fps diverge");
+    check(at30.position == atUncapped.position && at30.velocity == atUncapped.velocity, "30 fps and uncapped diverge");
+
+    // SPIRAL OF DEATH - a frame longer than MAX_FRAME_TIME only runs the clamped number of ticks
+    GameLoop loop;
+    int ticks = loop.advance(sf::seconds(5.0f), [](float) {});
+    check(ticks == static_cast<int>(sf::seconds(MAX_FRAME_TIME).asMicroseconds() / loop.getTickDuration().asMicroseconds()),
+          "long frame not clamped");
+
+    // INTERPOLATION - alpha is the leftover fraction of a tick
+    GameLoop halfTick;
+    halfTick.advance(sf::microseconds(halfTick.getTickDuration().asMicroseconds() * 3 / 2), [](float) {});
+    check(halfTick.getTickCount() == 1, "one and a half ticks did not run exactly one tick");
+    check(halfTick.getAlpha() > 0.49f && halfTick.getAlpha() < 0.51f, "alpha is not half a tick");
+    check(interpolate(10.0f, 20.0f, halfTick.getAlpha()) > 14.9f && interpolate(10.0f, 20.0f, halfTick.getAlpha()) < 15.1f,
+          "interpolated state is not halfway");
+
+    return reportChecks("GameLoop");
+}
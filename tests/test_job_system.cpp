@@ -0,0 +1,41 @@
+#include <SFML/System/Time.hpp>
+#include <atomic>
+#include "JobSystem.h"
+#include "check.h"
+
+int main()
+{
+    // NESTED and cross-pool submits: a worker of one pool must not use its index in another pool
+    {
+        JobSystem large(4), small(1);
+        std::atomic<int> ran{0};
+        for (int i = 0; i < 64; i++)
+        {
+            large.submit([&]()
+            {
+                small.submit([&ran]() { ran++; });
+                large.submit([&ran]() { ran++; }, JobPriority::High);
+            });
+        }
+        large.waitIdle();
+        small.waitIdle();
+        check(ran == 128, "nested or cross-pool jobs did not all run");
+        check(large.getStats().executedJobs == 128, "executed job count is wrong");
+    }
+
+    // CONTINUATIONS only run on the thread draining them
+    {
+        JobSystem jobs(2);
+        int continuations = 0; // Main thread only, no synchronisation needed
+        for (int i = 0; i < 10; i++)
+        {
+            jobs.submit([&]() { jobs.runOnMainThread([&continuations]() { continuations++; }); });
+        }
+        jobs.waitIdle();
+        check(jobs.getStats().mainThreadQueueDepth == 10, "continuations not queued for the main thread");
+        check(jobs.drainMainThread(sf::seconds(1.0f)) == 10 && continuations == 10, "continuations not drained");
+        check(jobs.drainMainThread(sf::Time::Zero) == 0, "drain ran past an empty budget");
+    }
+
+    return reportChecks("JobSystem");
+}